@@ -8,6 +8,7 @@ using namespace std;
 // Segment implementation
 Segment::Segment(const std::string &t, int d) : title(t), durationMinutes(d) {}
 Segment::~Segment() = default;
+int Segment::getDurationMinutes() const { return durationMinutes; }
 void Segment::display() const {
     cout << "Segment: " << title << " (" << durationMinutes << " min)\n";
 }
@@ -76,6 +77,11 @@ void Course::setCertificate(bool c) { certificate = c; }
 bool Course::hasCertificate() const { return certificate; }
 
 void Course::addSegment(std::unique_ptr<Segment> seg) { segments.push_back(move(seg)); }
+std::size_t Course::getSegmentCount() const { return segments.size(); }
+const Segment* Course::getSegment(std::size_t index) const {
+    if (index >= segments.size()) return nullptr;
+    return segments[index].get();
+}
 void Course::display() const {
     cout << "\n========== Course Information ==========\n";
     cout << "ID: " << id << "\n";
@@ -85,7 +91,6 @@ void Course::display() const {
     cout << "Offer: " << offer << "\n";
     cout << "Topic: " << topic << "\n";
     cout << "Outline: " << outline << "\n";
-    cout << "Progress: " << progress << "\n";
     cout << "Certificate: " << (certificate ? "Available ✅" : "Not Available ❌") << "\n";
     cout << "Segments:\n";
     for (const auto &s : segments) s->display();
@@ -24,6 +24,7 @@ protected:
 public:
     Segment(const std::string &t = "", int d = 0);
     virtual ~Segment();
+    int getDurationMinutes() const;
     virtual void display() const;
     virtual std::string serialize() const;
     static std::unique_ptr<Segment> deserialize(const std::string &line);
@@ -54,7 +55,7 @@ class Course {
     std::string offer;
     std::string topic;
     std::string outline;
-    std::string progress;
+    std::string progress; // legacy free-form field, kept for courses.db compatibility; see ProgressTracker
     bool certificate;
     std::vector<std::unique_ptr<Segment>> segments;
 public:
@@ -81,6 +82,8 @@ public:
 
     // segments
     void addSegment(std::unique_ptr<Segment> seg);
+    std::size_t getSegmentCount() const;
+    const Segment* getSegment(std::size_t index) const;
     void display() const;
 
     // serialization
@@ -6,6 +6,7 @@
 #include "course.h"
 #include "content.h"
 #include "admin.h"
+#include "progress.h"
 
 using namespace std;
 
@@ -13,10 +14,12 @@ int main() {
     CourseManager manager;
     EnrollmentManager enrollMgr;
     Content courseContent;
+    ProgressTracker progressTracker;
 
     const string coursesFile = "courses.db";
     const string enrollFile = "enrollments.db";
     const string contentFile = "content.txt";
+    const string progressFile = "progress.db";
 
     // sample users
     vector< unique_ptr<User> > users;
@@ -28,6 +31,7 @@ int main() {
     if (manager.loadFromFile(coursesFile)) cout << "Loaded courses from " << coursesFile << "\n";
     enrollMgr.load(enrollFile);
     courseContent.loadFromFile(contentFile);
+    progressTracker.load(progressFile);
 
     int choice;
     do {
@@ -42,6 +46,9 @@ int main() {
         cout << "8. Load Data\n";
         cout << "9. Print Manager Summary (friend func)\n";
         cout << "10. Manage Course Content (lectures/videos/notes)\n";
+        cout << "11. Mark Segment Completed (Student)\n";
+        cout << "12. Display Student Progress\n";
+        cout << "13. Course Completion Report\n";
         cout << "0. Exit\n";
         cout << "Choose: ";
         if (!(cin >> choice)) {
@@ -52,7 +59,7 @@ int main() {
 
         if (choice == 1) {
             Course c;
-            string id, title, dur, offer, topic, outline, progress;
+            string id, title, dur, offer, topic, outline;
             int price; bool cert;
             cout << "Course ID: "; getline(cin, id);
             cout << "Title: "; getline(cin, title);
@@ -61,12 +68,11 @@ int main() {
             cout << "Offer: "; getline(cin, offer);
             cout << "Topic: "; getline(cin, topic);
             cout << "Outline: "; getline(cin, outline);
-            cout << "Progress (e.g., 0%): "; getline(cin, progress);
             cout << "Certificate available? (1=Yes 0=No): "; cin >> cert; cin.ignore();
 
             c.setId(id); c.setTitle(title); c.setDurationStr(dur); c.setPrice(price);
             c.setOffer(offer); c.setTopic(topic); c.setOutline(outline);
-            c.setProgress(progress); c.setCertificate(cert);
+            c.setCertificate(cert);
 
             c.addSegment( make_unique<VideoSegment>("Intro Video", 10, "https://example.com/intro") );
             manager += move(c);
@@ -120,12 +126,14 @@ int main() {
             bool ok1 = manager.saveToFile(coursesFile);
             bool ok2 = enrollMgr.save(enrollFile);
             bool ok3 = courseContent.saveToFile(contentFile);
+            bool ok4 = progressTracker.save(progressFile);
             cout << "Save courses: " << (ok1 ? "OK" : "Failed") << ", enrollments: " << (ok2 ? "OK" : "Failed")
-                 << ", content: " << (ok3 ? "OK" : "Failed") << "\n";
+                 << ", content: " << (ok3 ? "OK" : "Failed") << ", progress: " << (ok4 ? "OK" : "Failed") << "\n";
         } else if (choice == 8) {
             if (manager.loadFromFile(coursesFile)) cout << "Courses loaded.\n"; else cout << "Failed to load courses.\n";
             if (enrollMgr.load(enrollFile)) cout << "Enrollments loaded.\n"; else cout << "No enrollments or failed.\n";
             if (courseContent.loadFromFile(contentFile)) cout << "Content loaded.\n"; else cout << "No content file or failed.\n";
+            if (progressTracker.load(progressFile)) cout << "Progress loaded.\n"; else cout << "No progress file or failed.\n";
         } else if (choice == 9) {
             printSummary(manager);
         } else if (choice == 10) {
@@ -141,6 +149,29 @@ int main() {
             else if (cch == 6) { cout << "Assignment: "; getline(cin,s); courseContent.addAssignment(s); }
             else if (cch == 7) courseContent.displayAll();
             else cout << "Invalid\n";
+        } else if (choice == 11) {
+            string sid, cid; cout << "Student ID: "; getline(cin, sid); cout << "Course ID: "; getline(cin, cid);
+            Course* cp = manager.getCoursePtr(cid);
+            if (!cp) { cout << "Course not found.\n"; continue; }
+            if (!enrollMgr.isEnrolled(sid, cid)) { cout << "Student is not enrolled in this course.\n"; continue; }
+            cout << "Segment number (1-" << cp->getSegmentCount() << ", 0=all): ";
+            size_t n; if (!(cin >> n)) { cin.clear(); string d; getline(cin,d); cout<<"Invalid\n"; continue; }
+            cin.ignore();
+            if (n == 0) { progressTracker.markCourseComplete(sid, *cp); cout << "All segments marked completed.\n"; }
+            else if (progressTracker.markSegmentComplete(sid, *cp, n - 1)) cout << "Segment marked completed.\n";
+            else cout << "Invalid segment number.\n";
+        } else if (choice == 12) {
+            string sid, cid; cout << "Student ID: "; getline(cin, sid); cout << "Course ID: "; getline(cin, cid);
+            Course* cp = manager.getCoursePtr(cid);
+            if (!cp) { cout << "Course not found.\n"; continue; }
+            progressTracker.displayProgress(sid, *cp);
+        } else if (choice == 13) {
+            string cid; cout << "Course ID: "; getline(cin, cid);
+            Course* cp = manager.getCoursePtr(cid);
+            if (!cp) { cout << "Course not found.\n"; continue; }
+            auto report = progressTracker.courseCompletion(*cp);
+            cout << "\n--- Completion for " << cid << " (" << report.size() << " students) ---\n";
+            for (const auto &p : report) cout << "- " << p.first << ": " << p.second << "%\n";
         } else if (choice == 0) {
             cout << "Exiting program...\n";
         } else cout << "Invalid choice.\n";
@@ -150,5 +181,6 @@ int main() {
     manager.saveToFile(coursesFile);
     enrollMgr.save(enrollFile);
     courseContent.saveToFile(contentFile);
+    progressTracker.save(progressFile);
     return 0;
 }
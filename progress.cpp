@@ -0,0 +1,217 @@
+#include "progress.h"
+#include <bit>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+using namespace std;
+
+// SegmentBitset
+void SegmentBitset::set(std::size_t index) {
+    size_t w = index / 64;
+    if (w >= words.size()) words.resize(w + 1, 0);
+    words[w] |= uint64_t(1) << (index % 64);
+}
+
+void SegmentBitset::reset(std::size_t index) {
+    size_t w = index / 64;
+    if (w < words.size()) words[w] &= ~(uint64_t(1) << (index % 64));
+}
+
+bool SegmentBitset::test(std::size_t index) const {
+    size_t w = index / 64;
+    return w < words.size() && (words[w] >> (index % 64)) & 1;
+}
+
+// only bits for segments that still exist in the course are counted
+std::size_t SegmentBitset::countBelow(std::size_t limit) const {
+    size_t full = min(limit / 64, words.size());
+    size_t n = 0;
+    for (size_t i = 0; i < full; ++i) n += popcount(words[i]);
+    if (full < words.size() && limit % 64) n += popcount(words[full] & ((uint64_t(1) << (limit % 64)) - 1));
+    return n;
+}
+
+std::vector<std::size_t> SegmentBitset::setIndices() const {
+    vector<size_t> out;
+    for (size_t i = 0; i < words.size(); ++i) {
+        uint64_t w = words[i];
+        while (w) {
+            out.push_back(i * 64 + countr_zero(w));
+            w &= w - 1;
+        }
+    }
+    return out;
+}
+
+std::string SegmentBitset::toHex() const {
+    if (words.empty()) return "0";
+    ostringstream oss;
+    oss << hex;
+    for (size_t i = 0; i < words.size(); ++i) {
+        if (i) oss << ",";
+        oss << words[i];
+    }
+    return oss.str();
+}
+
+// each comma-separated field must be 1-16 hex digits; returns false on malformed input
+bool SegmentBitset::fromHex(const std::string &hexStr, SegmentBitset &out) {
+    SegmentBitset b;
+    string tmp;
+    istringstream iss(hexStr);
+    while (getline(iss, tmp, ',')) {
+        if (tmp.empty() || tmp.size() > 16) return false;
+        if (tmp.find_first_not_of("0123456789abcdefABCDEF") != string::npos) return false;
+        b.words.push_back(stoull(tmp, nullptr, 16));
+    }
+    if (b.words.empty()) return false;
+    while (!b.words.empty() && b.words.back() == 0) b.words.pop_back();
+    out = move(b);
+    return true;
+}
+
+// ProgressTracker
+const SegmentBitset* ProgressTracker::find(const std::string &studentId, const std::string &courseId) const {
+    auto cit = progress.find(courseId);
+    if (cit == progress.end()) return nullptr;
+    auto sit = cit->second.find(studentId);
+    if (sit == cit->second.end()) return nullptr;
+    return &sit->second;
+}
+
+bool ProgressTracker::markSegmentComplete(const std::string &studentId, const Course &course, std::size_t segmentIndex) {
+    if (segmentIndex >= course.getSegmentCount()) return false;
+    progress[course.getId()][studentId].set(segmentIndex);
+    return true;
+}
+
+int ProgressTracker::markSegmentsComplete(const std::string &studentId, const Course &course, const std::vector<std::size_t> &segmentIndices) {
+    SegmentBitset *bits = nullptr; // created on the first valid index only
+    int marked = 0;
+    for (auto idx : segmentIndices) {
+        if (idx >= course.getSegmentCount()) continue;
+        if (!bits) bits = &progress[course.getId()][studentId];
+        bits->set(idx);
+        ++marked;
+    }
+    return marked;
+}
+
+int ProgressTracker::markSegmentCompleteForStudents(const std::vector<std::string> &studentIds, const Course &course, std::size_t segmentIndex) {
+    if (segmentIndex >= course.getSegmentCount()) return 0;
+    auto &students = progress[course.getId()];
+    int changed = 0;
+    for (const auto &sid : studentIds) {
+        SegmentBitset &bits = students[sid];
+        if (bits.test(segmentIndex)) continue;
+        bits.set(segmentIndex);
+        ++changed;
+    }
+    return changed;
+}
+
+void ProgressTracker::markCourseComplete(const std::string &studentId, const Course &course) {
+    SegmentBitset &bits = progress[course.getId()][studentId];
+    for (size_t i = 0; i < course.getSegmentCount(); ++i) bits.set(i);
+}
+
+bool ProgressTracker::unmarkSegment(const std::string &studentId, const Course &course, std::size_t segmentIndex) {
+    if (segmentIndex >= course.getSegmentCount()) return false;
+    auto cit = progress.find(course.getId());
+    if (cit == progress.end()) return false;
+    auto sit = cit->second.find(studentId);
+    if (sit == cit->second.end()) return false;
+    sit->second.reset(segmentIndex);
+    return true;
+}
+
+void ProgressTracker::resetProgress(const std::string &studentId, const std::string &courseId) {
+    auto cit = progress.find(courseId);
+    if (cit == progress.end()) return;
+    cit->second.erase(studentId);
+    if (cit->second.empty()) progress.erase(cit);
+}
+
+bool ProgressTracker::isSegmentComplete(const std::string &studentId, const std::string &courseId, std::size_t segmentIndex) const {
+    const SegmentBitset *bits = find(studentId, courseId);
+    return bits && bits->test(segmentIndex);
+}
+
+std::size_t ProgressTracker::completedSegments(const std::string &studentId, const Course &course) const {
+    const SegmentBitset *bits = find(studentId, course.getId());
+    return bits ? bits->countBelow(course.getSegmentCount()) : 0;
+}
+
+int ProgressTracker::percentComplete(const std::string &studentId, const Course &course) const {
+    size_t total = course.getSegmentCount();
+    const SegmentBitset *bits = find(studentId, course.getId());
+    if (!bits || total == 0) return 0;
+    return static_cast<int>(bits->countBelow(total) * 100 / total);
+}
+
+int ProgressTracker::minutesWatched(const std::string &studentId, const Course &course) const {
+    const SegmentBitset *bits = find(studentId, course.getId());
+    if (!bits) return 0;
+    int minutes = 0;
+    for (auto idx : bits->setIndices()) {
+        const Segment *seg = course.getSegment(idx);
+        if (seg) minutes += seg->getDurationMinutes();
+    }
+    return minutes;
+}
+
+bool ProgressTracker::isCertificateEligible(const std::string &studentId, const Course &course) const {
+    size_t total = course.getSegmentCount();
+    if (!course.hasCertificate() || total == 0) return false;
+    const SegmentBitset *bits = find(studentId, course.getId());
+    return bits && bits->countBelow(total) == total;
+}
+
+std::vector< SimplePair<std::string, int> > ProgressTracker::courseCompletion(const Course &course) const {
+    vector< SimplePair<string, int> > out;
+    auto cit = progress.find(course.getId());
+    size_t total = course.getSegmentCount();
+    if (cit == progress.end() || total == 0) return out;
+    out.reserve(cit->second.size());
+    for (const auto &kv : cit->second)
+        out.emplace_back(kv.first, static_cast<int>(kv.second.countBelow(total) * 100 / total));
+    return out;
+}
+
+void ProgressTracker::displayProgress(const std::string &studentId, const Course &course) const {
+    cout << "\n--- Progress: " << studentId << " in " << course.getId() << " ---\n";
+    cout << "Completed segments: " << completedSegments(studentId, course) << "/" << course.getSegmentCount() << "\n";
+    cout << "Progress: " << percentComplete(studentId, course) << "%\n";
+    cout << "Minutes watched: " << minutesWatched(studentId, course) << "\n";
+    cout << "Certificate: " << (isCertificateEligible(studentId, course) ? "Eligible ✅" : "Not Eligible ❌") << "\n";
+}
+
+bool ProgressTracker::save(const std::string &filename) const {
+    ofstream ofs(filename, ios::trunc);
+    if (!ofs) return false;
+    for (const auto &ckv : progress)
+        for (const auto &skv : ckv.second) ofs << skv.first << "|" << ckv.first << "|" << skv.second.toHex() << "\n";
+    return true;
+}
+
+bool ProgressTracker::load(const std::string &filename) {
+    ifstream ifs(filename);
+    if (!ifs) return false;
+    // parse into a fresh map so a failed read leaves the current state untouched
+    map<string, map<string, SegmentBitset>> loaded;
+    string line;
+    while (getline(ifs, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        auto p1 = line.find('|');
+        if (p1 == string::npos || p1 == 0) continue;
+        auto p2 = line.find('|', p1 + 1);
+        if (p2 == string::npos || p2 == p1 + 1) continue;
+        SegmentBitset bits;
+        if (!SegmentBitset::fromHex(line.substr(p2 + 1), bits)) continue; // skip malformed line
+        loaded[line.substr(p1 + 1, p2 - p1 - 1)][line.substr(0, p1)] = move(bits);
+    }
+    if (ifs.bad()) return false;
+    progress = move(loaded);
+    return true;
+}
@@ -0,0 +1,50 @@
+#ifndef PROGRESS_H
+#define PROGRESS_H
+
+#include "course.h"
+#include <cstdint>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+// Completed segments of one student in one course, one bit per segment position
+class SegmentBitset {
+    std::vector<std::uint64_t> words;
+public:
+    SegmentBitset() = default;
+    void set(std::size_t index);
+    void reset(std::size_t index);
+    bool test(std::size_t index) const;
+    std::size_t countBelow(std::size_t limit) const;
+    std::vector<std::size_t> setIndices() const;
+    std::string toHex() const;
+    static bool fromHex(const std::string &hex, SegmentBitset &out);
+};
+
+// ProgressTracker records segment completions per (student, course)
+class ProgressTracker {
+    std::map<std::string, std::map<std::string, SegmentBitset>> progress; // courseId -> studentId -> bits
+    const SegmentBitset* find(const std::string &studentId, const std::string &courseId) const;
+public:
+    bool markSegmentComplete(const std::string &studentId, const Course &course, std::size_t segmentIndex);
+    int markSegmentsComplete(const std::string &studentId, const Course &course, const std::vector<std::size_t> &segmentIndices);
+    // callers pass enrolled student IDs; returns the number of students newly marked
+    int markSegmentCompleteForStudents(const std::vector<std::string> &studentIds, const Course &course, std::size_t segmentIndex);
+    void markCourseComplete(const std::string &studentId, const Course &course);
+    bool unmarkSegment(const std::string &studentId, const Course &course, std::size_t segmentIndex);
+    void resetProgress(const std::string &studentId, const std::string &courseId);
+
+    bool isSegmentComplete(const std::string &studentId, const std::string &courseId, std::size_t segmentIndex) const;
+    std::size_t completedSegments(const std::string &studentId, const Course &course) const;
+    int percentComplete(const std::string &studentId, const Course &course) const;
+    int minutesWatched(const std::string &studentId, const Course &course) const;
+    bool isCertificateEligible(const std::string &studentId, const Course &course) const;
+    std::vector< SimplePair<std::string, int> > courseCompletion(const Course &course) const; // studentId, percent
+
+    void displayProgress(const std::string &studentId, const Course &course) const;
+    bool save(const std::string &filename) const;
+    bool load(const std::string &filename);
+};
+
+#endif // PROGRESS_H